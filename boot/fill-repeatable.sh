@@ -145,6 +145,61 @@ function main() {
   eosc tx create --force-unique battlefield1 creaorder '{"n1": "notified1", "n2": "notified2", "n3": "notified3", "n4": "notified4", "n5": "notified5"}' -p battlefield1
   sleep 0.6
 
+  ## Series of test for cross-account inline relay (battlefield1 -> battlefield3 -> notified2 -> ...), limited
+  ## to 5 hops by the default `max_inline_action_depth` of 4
+
+  relay_payload=`printf 'r%.0s' {1..512}`
+  eosc tx create battlefield1 relay '{"route": ["battlefield1", "battlefield3", "notified2"], "hop": 0, "hops": 3, "payload": "", "write": false}' -p battlefield1
+  eosc tx create battlefield1 relay "{\"route\": [\"battlefield1\", \"battlefield3\", \"notified2\"], \"hop\": 0, \"hops\": 5, \"payload\": \"$relay_payload\", \"write\": true}" -p battlefield1
+  sleep 0.6
+
+  ## Series of test for authorization checks against large authorities (set on battlefield6 by `run.sh`)
+
+  eosc tx create battlefield1 authcheck '{"levels": [{"actor": "battlefield1", "permission": "active"}, {"actor": "battlefield3", "permission": "active"}, {"actor": "notified1", "permission": "active"}, {"actor": "notified3", "permission": "active"}, {"actor": "notified4", "permission": "active"}, {"actor": "notified5", "permission": "active"}], "require": true}' -p battlefield1 -p battlefield3 -p notified1 -p notified3 -p notified4 -p notified5
+  eosc tx create battlefield1 authcheck '{"levels": [{"actor": "battlefield1", "permission": "active"}, {"actor": "battlefield3", "permission": "active"}, {"actor": "notified1", "permission": "active"}, {"actor": "notified3", "permission": "active"}, {"actor": "notified4", "permission": "active"}, {"actor": "notified5", "permission": "active"}], "require": false}' -p battlefield1
+  sleep 0.6
+
+  eosc tx create battlefield1 authperm '{"account": "battlefield6", "permission": "manykeys", "keys": ["EOS4xbaEeAm2Q5LoyAWgKYoMcUtXTvhk6bRDn4jQSEPDT5fgWJNiq", "EOS4zTJFHQ6Yd9ePRC9fNA2n1q1xbw5Ndx1uMC9pL1mFSkoZejB79", "EOS5aFk5JpcTK9BDx5huuh2HA7RyY1rJJ2HHEoqXXnnvxDVEAtfAQ", "EOS5bhkPXqjUXEeiTF1pN6yxM1LHoovXjkydW5VoUqczuNV4Bhgiw", "EOS5w9YACB4S1dJZifbtZEjZeDAeqy76p4gnoUbdzboqLwb9kocCs", "EOS5zjD6LTkaxVKHuSwuD6bGF1CMQnmFmcxa3U4m1aJbM7PxvCYg9", "EOS6iNSFvjoHUFq7E1VQpmtFoKhEzFJnb8eXVDX9w8eaEqvN33D9H", "EOS6mpqW8PNkXHJqvRk1BAyaCMnazBCLU2psYHsSQtNMRBfudCXQx", "EOS6z8hT3pk574VPXVdWzgygKBLjCGWhc4RxapmxFf7p1fCmwp6GW", "EOS736KvCKFopLTP9BA3NFSVN2Vsi8TSe1Bn38Em5m74jeaWgeSVb", "EOS7C7Rz6nS7hUiHuHGQtwCZwDavxLWKXCU8Rf4Zp8Ft31jpL4Pzr", "EOS7Hxw2DiEoG5cSBwWLka1b5jwoNe8pRJCt6QPEuuNaxhDXqQkNM", "EOS7RXFvzJZz97axDcWFXCNfLudhdzHNoJq8DHgsbnSgk4ZeqdjJX", "EOS7djq8hgPwjQcybXdN3mpRvYB8jYUvTR5swxQY5iRHyTmQHWRqG", "EOS8EYZLRgaa3Q7t5nyHidgXnqUMNpN1DHw1PD5Ax7xqj464Xw9cf", "EOS8jVCbPjJwkSS3mb56ijZujw8CNsqkkRWiMHX1jfLmVMQoTFj1v"], "perms": [], "iterations": 10, "expected": true}' -p battlefield1
+  eosc tx create battlefield1 authperm '{"account": "battlefield6", "permission": "manykeys", "keys": ["EOS4xbaEeAm2Q5LoyAWgKYoMcUtXTvhk6bRDn4jQSEPDT5fgWJNiq", "EOS4zTJFHQ6Yd9ePRC9fNA2n1q1xbw5Ndx1uMC9pL1mFSkoZejB79", "EOS5aFk5JpcTK9BDx5huuh2HA7RyY1rJJ2HHEoqXXnnvxDVEAtfAQ", "EOS5bhkPXqjUXEeiTF1pN6yxM1LHoovXjkydW5VoUqczuNV4Bhgiw", "EOS5w9YACB4S1dJZifbtZEjZeDAeqy76p4gnoUbdzboqLwb9kocCs", "EOS5zjD6LTkaxVKHuSwuD6bGF1CMQnmFmcxa3U4m1aJbM7PxvCYg9", "EOS6iNSFvjoHUFq7E1VQpmtFoKhEzFJnb8eXVDX9w8eaEqvN33D9H", "EOS6mpqW8PNkXHJqvRk1BAyaCMnazBCLU2psYHsSQtNMRBfudCXQx", "EOS6z8hT3pk574VPXVdWzgygKBLjCGWhc4RxapmxFf7p1fCmwp6GW", "EOS736KvCKFopLTP9BA3NFSVN2Vsi8TSe1Bn38Em5m74jeaWgeSVb", "EOS7C7Rz6nS7hUiHuHGQtwCZwDavxLWKXCU8Rf4Zp8Ft31jpL4Pzr", "EOS7Hxw2DiEoG5cSBwWLka1b5jwoNe8pRJCt6QPEuuNaxhDXqQkNM", "EOS7RXFvzJZz97axDcWFXCNfLudhdzHNoJq8DHgsbnSgk4ZeqdjJX", "EOS7djq8hgPwjQcybXdN3mpRvYB8jYUvTR5swxQY5iRHyTmQHWRqG", "EOS8EYZLRgaa3Q7t5nyHidgXnqUMNpN1DHw1PD5Ax7xqj464Xw9cf"], "perms": [], "iterations": 10, "expected": false}' -p battlefield1
+  eosc tx create battlefield1 authperm '{"account": "battlefield6", "permission": "manyaccts", "keys": [], "perms": [{"actor": "battlefield1", "permission": "active"}, {"actor": "battlefield2", "permission": "active"}, {"actor": "battlefield3", "permission": "active"}, {"actor": "battlefield4", "permission": "active"}, {"actor": "battlefield5", "permission": "active"}, {"actor": "notified1", "permission": "active"}, {"actor": "notified2", "permission": "active"}, {"actor": "notified3", "permission": "active"}, {"actor": "notified4", "permission": "active"}, {"actor": "notified5", "permission": "active"}, {"actor": "zzzzzzzzzzzz", "permission": "active"}], "iterations": 10, "expected": true}' -p battlefield1
+  eosc tx create battlefield1 authperm '{"account": "battlefield6", "permission": "manyaccts", "keys": ["EOS5MHPYyhjBjnQZejzZHqHewPWhGTfQWSVTWYEhDmJu4SXkzgweP"], "perms": [], "iterations": 10, "expected": true}' -p battlefield1
+  eosc tx create battlefield1 authperm '{"account": "battlefield6", "permission": "deep1", "keys": ["EOS5MHPYyhjBjnQZejzZHqHewPWhGTfQWSVTWYEhDmJu4SXkzgweP"], "perms": [], "iterations": 10, "expected": true}' -p battlefield1
+  sleep 0.6
+
+  ## Series of test for hot-row (spread of 1) versus spread-row (spread of 1000) updates
+
+  for seq in 1 2 3; do
+    eosc tx create battlefield1 hotrow "{\"by\": \"primary\", \"spread\": 1, \"seq\": $seq, \"count\": 10}" -p battlefield1
+    eosc tx create battlefield1 hotrow "{\"by\": \"secondary\", \"spread\": 1, \"seq\": $seq, \"count\": 10}" -p battlefield1
+    eosc tx create battlefield1 hotrow "{\"by\": \"primary\", \"spread\": 1000, \"seq\": $seq, \"count\": 10}" -p battlefield1
+    eosc tx create battlefield1 hotrow "{\"by\": \"secondary\", \"spread\": 1000, \"seq\": $seq, \"count\": 10}" -p battlefield1
+  done
+  sleep 0.6
+
+  ## Series of test for data-driven scenarios (steps are interpreted by `runscenario`, see `scenario_op`)
+
+  eosc tx create battlefield1 setscenario '{"id": 1, "steps": [{"op": 0, "account": "", "value": 1, "text": "scenario row"}, {"op": 2, "account": "battlefield3", "value": 0, "text": "scenario inline"}, {"op": 3, "account": "notified1", "value": 0, "text": ""}, {"op": 5, "account": "", "value": 0, "text": "scenario print"}, {"op": 1, "account": "", "value": 1, "text": ""}]}' -p battlefield1
+  eosc tx create battlefield1 setscenario '{"id": 2, "steps": [{"op": 4, "account": "", "value": 1, "text": "scenario deferred"}, {"op": 6, "account": "", "value": 0, "text": "scenario instructed to fail"}]}' -p battlefield1
+  eosc tx create battlefield1 setscenario '{"id": 3, "steps": [{"op": 0, "account": "", "value": 2, "text": "scenario deferred row"}, {"op": 4, "account": "", "value": 1, "text": "scenario deferred"}]}' -p battlefield1
+  sleep 0.6
+
+  eosc tx create battlefield1 runscenario '{"id": 1, "repeat": 10}' -p battlefield1
+  eosc tx create battlefield1 runscenario '{"id": 3, "repeat": 2}' -p battlefield1
+  echo ""
+  echo "Waiting for the scenario deferred transactions to execute..."
+  sleep 1.1
+
+  eosc tx create battlefield1 runscenario '{"id": 2, "repeat": 1}' -p battlefield1 || true
+  sleep 0.6
+  echo "The error message you see above ^^^ is OK, we were expecting the transaction to fail, continuing...."
+
+  ## Series of test for WASM linear memory growth and large in-contract allocations
+
+  eosc tx create battlefield1 memstress '{"bytes": 1048576, "pattern": "sequential", "touches": 16}' -p battlefield1
+  eosc tx create battlefield1 memstress '{"bytes": 8388608, "pattern": "random", "touches": 1000}' -p battlefield1
+  eosc tx create battlefield1 memstress '{"bytes": 1048576, "pattern": "containers", "touches": 1000}' -p battlefield1
+  sleep 0.6
+
   ## Series of test for variant support
 
   eosc tx create battlefield1 varianttest '{"value":["uint16",12]}' -p battlefield1
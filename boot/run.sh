@@ -86,6 +86,28 @@ function main() {
   eosc system newaccount battlefield1 battlefield2 --auth-key EOS5MHPYyhjBjnQZejzZHqHewPWhGTfQWSVTWYEhDmJu4SXkzgweP --stake-cpu 1 --stake-net 1 --transfer
   sleep 0.6
 
+  echo ""
+  echo "Setting large authorities on battlefield6 (many keys, many accounts, deep hierarchy) for authorization checks"
+  eosc system updateauth battlefield6 manykeys active "$ROOT"/perms/battlefield6_manykeys_auth.yaml
+  eosc system updateauth battlefield6 manyaccts active "$ROOT"/perms/battlefield6_manyaccts_auth.yaml
+
+  # First pass only creates the deep1 -> deep5 parent chain, every level temporarily gets deep5's
+  # key-only authority (which is also deep5's final one) since a parent must exist before its child
+  eosc system updateauth battlefield6 deep1 active "$ROOT"/perms/battlefield6_deep5_auth.yaml
+  eosc system updateauth battlefield6 deep2 deep1 "$ROOT"/perms/battlefield6_deep5_auth.yaml
+  eosc system updateauth battlefield6 deep3 deep2 "$ROOT"/perms/battlefield6_deep5_auth.yaml
+  eosc system updateauth battlefield6 deep4 deep3 "$ROOT"/perms/battlefield6_deep5_auth.yaml
+  eosc system updateauth battlefield6 deep5 deep4 "$ROOT"/perms/battlefield6_deep5_auth.yaml
+  sleep 0.6
+
+  # Second pass sets the final deep1 to deep4 authorities, each referencing the next level. Permissions
+  # referenced by an authority must exist, so the chain is linked bottom-up
+  eosc system updateauth battlefield6 deep4 deep3 "$ROOT"/perms/battlefield6_deep4_auth.yaml
+  eosc system updateauth battlefield6 deep3 deep2 "$ROOT"/perms/battlefield6_deep3_auth.yaml
+  eosc system updateauth battlefield6 deep2 deep1 "$ROOT"/perms/battlefield6_deep2_auth.yaml
+  eosc system updateauth battlefield6 deep1 active "$ROOT"/perms/battlefield6_deep1_auth.yaml
+  sleep 0.6
+
   echo ""
   echo "Generating coverage transaction (those can be repeated to generate traffic)"
   set +e
@@ -5,12 +5,16 @@
 // #endif
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <variant>
 
 #include <eosio/eosio.hpp>
 #include <eosio/crypto.hpp>
 #include <eosio/asset.hpp>
+#include <eosio/permission.hpp>
 #include <eosio/time.hpp>
 #include <eosio/transaction.hpp>
 
@@ -29,6 +33,7 @@ using eosio::name;
 using eosio::onerror;
 using eosio::permission_level;
 using eosio::print;
+using eosio::public_key;
 using eosio::time_point_sec;
 using std::function;
 using std::string;
@@ -38,6 +43,32 @@ class [[eosio::contract("battlefield")]] battlefield : public contract
 public:
     typedef std::variant<uint16_t, string> varying_action;
 
+    enum scenario_op : uint8_t
+    {
+        // Upserts row `value` of the `scendata` table with `text` as its memo
+        scenario_store = 0,
+        // Erases row `value` of the `scendata` table, if it exists
+        scenario_erase = 1,
+        // Sends `inlineempty` to `account` tagged `text`, failing if `value` is non-zero
+        scenario_inline = 2,
+        // Notifies `account` (require_recipient)
+        scenario_notify = 3,
+        // Sends a deferred `inlineempty` to self tagged `text`, delayed by `value` seconds
+        scenario_deferred = 4,
+        // Prints `text`
+        scenario_print = 5,
+        // Fails with `text` as the error message
+        scenario_fail = 6,
+    };
+
+    struct scenario_step
+    {
+        uint8_t op;
+        name account;
+        uint64_t value;
+        string text;
+    };
+
     battlefield(name receiver, name code, datastream<const char *> ds)
         : contract(receiver, code, ds) {}
 
@@ -74,6 +105,64 @@ public:
 
     [[eosio::action]] void sktest(name action);
 
+    /**
+     * Performs `count` balance updates on the `hot` table, accessing rows either by
+     * primary key (`by` is `primary`) or through the `bykey` secondary index (`by` is
+     * `secondary`). Update `i` targets row `(seq * count + i) % spread`, so a `spread`
+     * of 0 or 1 makes every transaction modify the same row while a large `spread`
+     * with a distinct `seq` per transaction gives each transaction its own rows.
+     * Rows are created on first access.
+     *
+     * Row `id` has its `bykey` secondary key in the `[id << 32, (id + 1) << 32)` range,
+     * the `secondary` mode bumps its lower 32 bits on each update so the secondary
+     * index entry is rewritten, like `sktest` does with `update.sk`.
+     */
+    [[eosio::action]] void hotrow(name by, uint64_t spread, uint64_t seq, uint32_t count);
+
+    /**
+     * Grows the WASM linear memory by allocating an uninitialized `bytes` sized
+     * buffer (the VM limits how large it can be), then performs `touches` operations
+     * based on `pattern`:
+     *  - sequential | Writes one byte per 64 KiB page of the buffer, page after page
+     *  - random     | Writes one byte at a pseudo-random offset of the buffer
+     *  - containers | Builds `touches` entries in a `std::map` and a `std::vector<string>`,
+     *                 allocated after the buffer, then drops them
+     */
+    [[eosio::action]] void memstress(uint32_t bytes, name pattern, uint32_t touches);
+
+    /**
+     * Stores the `steps` of scenario `id`, replacing any previous version, an empty
+     * list of steps removes the scenario.
+     */
+    [[eosio::action]] void setscenario(uint64_t id, std::vector<scenario_step> steps);
+
+    /**
+     * Interprets the steps of scenario `id` in order, `repeat` times. See `scenario_op`
+     * for the meaning of each step's fields.
+     */
+    [[eosio::action]] void runscenario(uint64_t id, uint32_t repeat);
+
+    /**
+     * Checks every permission level of `levels` against the transaction authorizations,
+     * using `require_auth(level)` when `require` is set and `has_auth(level.actor)` otherwise.
+     */
+    [[eosio::action]] void authcheck(std::vector<permission_level> levels, bool require);
+
+    /**
+     * Runs `check_permission_authorization` on `account@permission` for `iterations` times
+     * with the provided keys and permissions, failing if the outcome is not `expected`.
+     *
+     * Meant to be used against the large authorities of `battlefield6` (`manykeys`,
+     * `manyaccts` and the `deep1` to `deep5` hierarchy) set up by `boot/run.sh`.
+     */
+    [[eosio::action]] void authperm(
+        name account,
+        name permission,
+        std::vector<public_key> keys,
+        std::vector<permission_level> perms,
+        uint32_t iterations,
+        bool expected);
+
 #if WITH_ONERROR_HANDLER == 1
     [[eosio::on_notify("eosio::onerror")]] void onerror(eosio::onerror data);
 #endif
@@ -153,11 +242,31 @@ public:
         bool nestedInlineFail,
         string nestedCfaInlineTag);
 
+    /**
+     * Forwards itself inline through the ordered `route` of battlefield accounts
+     * until `hops` hops were performed. Hop `N` executes on `route[N % route.size()]`.
+     *
+     * Each hop is sent inline by the previous one, so hop `N` runs at inline depth `N`
+     * and the chain is bounded by the chain's `max_inline_action_depth` (4 by default,
+     * which allows at most 5 hops).
+     *
+     * The `payload` is carried untouched on every hop, its size controls the
+     * action data size of each inline. The packed inline action (route and
+     * payload included) is bounded by the chain's `max_inline_action_size`
+     * (4 KiB by default). When `write` is set, each hop also stores
+     * a row (including the payload) in its own `relay` table.
+     *
+     * Every account in the route must have the battlefield contract installed
+     * and its `active` permission must be satisfied by its own `eosio.code`.
+     */
+    [[eosio::action]] void relay(std::vector<name> route, uint32_t hop, uint32_t hops, string payload, bool write);
+
     // Inline action wrappers (so we can construct them in code)
     using nestdtrxexec_action = action_wrapper<"nestdtrxexec"_n, &battlefield::nestdtrxexec>;
     using nestonerror_action = action_wrapper<"nestonerror"_n, &battlefield::nestonerror>;
     using inlineempty_action = action_wrapper<"inlineempty"_n, &battlefield::inlineempty>;
     using inlinedeep_action = action_wrapper<"inlinedeep"_n, &battlefield::inlinedeep>;
+    using relay_action = action_wrapper<"relay"_n, &battlefield::relay>;
 
 private:
     struct [[eosio::table]] member_row
@@ -189,6 +298,52 @@ private:
 
     typedef eosio::multi_index<"variant"_n, variant_row> variers;
 
+    struct [[eosio::table]] relay_row
+    {
+        uint64_t id;
+        uint32_t hop;
+        name from;
+        string payload;
+        time_point_sec created_at;
+
+        auto primary_key() const { return id; }
+    };
+
+    typedef eosio::multi_index<"relay"_n, relay_row> relays;
+
+    struct [[eosio::table]] scenario_row
+    {
+        uint64_t id;
+        std::vector<scenario_step> steps;
+
+        auto primary_key() const { return id; }
+    };
+
+    typedef eosio::multi_index<"scenario"_n, scenario_row> scenarios;
+
+    struct [[eosio::table]] scenario_data_row
+    {
+        uint64_t id;
+        string memo;
+
+        auto primary_key() const { return id; }
+    };
+
+    typedef eosio::multi_index<"scendata"_n, scenario_data_row> scenario_data;
+
+    struct [[eosio::table]] hot_row
+    {
+        uint64_t id;
+        uint64_t key;
+        uint64_t balance;
+        uint64_t updates;
+
+        auto primary_key() const { return id; }
+        uint64_t by_key() const { return key; }
+    };
+
+    typedef eosio::multi_index<"hot"_n, hot_row, indexed_by<"bykey"_n, const_mem_fun<hot_row, uint64_t, &hot_row::by_key>>> hots;
+
     // condary_index_db_functions< double >
     // struct secondary_index_db_functions< eosio::fixed_bytes< 32 > >
     // struct secondary_index_db_functions< long double >
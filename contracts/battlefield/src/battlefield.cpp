@@ -150,6 +150,255 @@ void battlefield::nestonerror(bool fail)
     check(!fail, "nestonerror instructed to fail");
 }
 
+void battlefield::hotrow(name by, uint64_t spread, uint64_t seq, uint32_t count)
+{
+    check(by == "primary"_n || by == "secondary"_n, "The by must be one of primary or secondary");
+    check(spread <= 0xFFFFFFFF, "The spread must fit in 32 bits");
+
+    hots hot_table(_self, _self.value);
+    auto key_index = hot_table.template get_index<"bykey"_n>();
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint64_t id = spread <= 1 ? 0 : (seq * count + i) % spread;
+
+        if (by == "primary"_n)
+        {
+            auto itr = hot_table.find(id);
+            if (itr != hot_table.end())
+            {
+                hot_table.modify(itr, _self, [&](auto &row) {
+                    row.balance = row.balance + seq + 1;
+                    row.updates = row.updates + 1;
+                });
+                continue;
+            }
+        }
+        else
+        {
+            // The secondary key moves with each update so the `bykey` index entry is rewritten
+            auto itr = key_index.lower_bound(id << 32);
+            if (itr != key_index.end() && (itr->key >> 32) == id)
+            {
+                key_index.modify(itr, _self, [&](auto &row) {
+                    row.key = (id << 32) | uint32_t(row.key + 1);
+                    row.balance = row.balance + seq + 1;
+                    row.updates = row.updates + 1;
+                });
+                continue;
+            }
+        }
+
+        hot_table.emplace(_self, [&](auto &row) {
+            row.id = id;
+            row.key = id << 32;
+            row.balance = seq + 1;
+            row.updates = 1;
+        });
+    }
+}
+
+void battlefield::memstress(uint32_t bytes, name pattern, uint32_t touches)
+{
+    check(pattern == "sequential"_n || pattern == "random"_n || pattern == "containers"_n,
+          "The pattern must be one of sequential, random or containers");
+    check(bytes > 0, "memstress requires a non-zero amount of bytes");
+
+    const uint32_t page_size = 64 * 1024;
+    const uint32_t page_count = (bytes + page_size - 1) / page_size;
+
+    // Left uninitialized on purpose, only the touched bytes are ever accessed. Each touch
+    // reads back into the printed checksum so the optimizer cannot drop the buffer.
+    std::unique_ptr<uint8_t[]> heap(new uint8_t[bytes]);
+    uint64_t checksum = 0;
+
+    if (pattern == "sequential"_n)
+    {
+        for (uint32_t i = 0; i < touches; ++i)
+        {
+            uint32_t offset = std::min((i % page_count) * page_size, bytes - 1);
+            heap[offset] += uint8_t(i);
+            checksum += heap[offset];
+        }
+    }
+    else if (pattern == "random"_n)
+    {
+        // Fixed seed xorshift, the access pattern must be deterministic across nodes
+        uint64_t state = 0x1122334455667788;
+        for (uint32_t i = 0; i < touches; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            uint32_t offset = uint32_t(state % bytes);
+            heap[offset] += uint8_t(i);
+            checksum += heap[offset];
+        }
+    }
+    else
+    {
+        std::map<uint64_t, uint64_t> entries;
+        std::vector<string> strings;
+
+        for (uint32_t i = 0; i < touches; ++i)
+        {
+            entries[uint64_t(i) * 0x9E3779B97F4A7C15] = i;
+            strings.emplace_back(64, char('a' + i % 26));
+        }
+
+        checksum = entries.size() + strings.size();
+    }
+
+    print("memstress allocated ", bytes, " bytes (", page_count, " pages), checksum ", checksum, "\n");
+}
+
+void battlefield::setscenario(uint64_t id, std::vector<scenario_step> steps)
+{
+    require_auth(_self);
+
+    for (const auto &step : steps)
+    {
+        check(step.op <= scenario_fail, "scenario step op is unknown");
+    }
+
+    scenarios scenario_table(_self, _self.value);
+    auto itr = scenario_table.find(id);
+
+    if (steps.empty())
+    {
+        check(itr != scenario_table.end(), "scenario does not exist");
+        scenario_table.erase(itr);
+    }
+    else if (itr == scenario_table.end())
+    {
+        scenario_table.emplace(_self, [&](auto &row) {
+            row.id = id;
+            row.steps = steps;
+        });
+    }
+    else
+    {
+        scenario_table.modify(itr, _self, [&](auto &row) {
+            row.steps = steps;
+        });
+    }
+}
+
+void battlefield::runscenario(uint64_t id, uint32_t repeat)
+{
+    scenarios scenario_table(_self, _self.value);
+    auto scenario = scenario_table.require_find(id, "scenario does not exist");
+
+    scenario_data data_table(_self, _self.value);
+
+    for (uint32_t i = 0; i < repeat; ++i)
+    {
+        for (uint32_t j = 0; j < scenario->steps.size(); ++j)
+        {
+            const auto &step = scenario->steps[j];
+
+            switch (step.op)
+            {
+            case scenario_store:
+            {
+                auto itr = data_table.find(step.value);
+                if (itr == data_table.end())
+                {
+                    data_table.emplace(_self, [&](auto &row) {
+                        row.id = step.value;
+                        row.memo = step.text;
+                    });
+                }
+                else
+                {
+                    data_table.modify(itr, _self, [&](auto &row) {
+                        row.memo = step.text;
+                    });
+                }
+                break;
+            }
+            case scenario_erase:
+            {
+                auto itr = data_table.find(step.value);
+                if (itr != data_table.end())
+                {
+                    data_table.erase(itr);
+                }
+                break;
+            }
+            case scenario_inline:
+            {
+                inlineempty_action inline_empty(step.account, {_self, "active"_n});
+                inline_empty.send(step.text, step.value != 0);
+                break;
+            }
+            case scenario_notify:
+                require_recipient(step.account);
+                break;
+            case scenario_deferred:
+            {
+                eosio::transaction deferred;
+                uint128_t sender_id = (uint128_t(id) << 64) | (uint128_t(i) << 32) | uint128_t(j);
+                deferred.actions.emplace_back(
+                    permission_level{_self, "active"_n},
+                    _self,
+                    "inlineempty"_n,
+                    std::make_tuple(step.text, false));
+                deferred.delay_sec = uint32_t(step.value);
+                deferred.send(sender_id, _self, true);
+                break;
+            }
+            case scenario_print:
+                print(step.text, "\n");
+                break;
+            case scenario_fail:
+                check(false, step.text);
+                break;
+            default:
+                check(false, "scenario step op is unknown");
+            }
+        }
+    }
+}
+
+void battlefield::authcheck(std::vector<permission_level> levels, bool require)
+{
+    uint32_t authorized = 0;
+    for (const auto &level : levels)
+    {
+        if (require)
+        {
+            require_auth(level);
+            authorized++;
+        }
+        else if (has_auth(level.actor))
+        {
+            authorized++;
+        }
+    }
+
+    print("authcheck authorized ", authorized, " out of ", levels.size(), " levels\n");
+}
+
+void battlefield::authperm(
+    name account,
+    name permission,
+    std::vector<public_key> keys,
+    std::vector<permission_level> perms,
+    uint32_t iterations,
+    bool expected)
+{
+    std::set<public_key> provided_keys(keys.begin(), keys.end());
+    std::set<permission_level> provided_permissions(perms.begin(), perms.end());
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        bool authorized = eosio::check_permission_authorization(account, permission, provided_keys, provided_permissions);
+        check(authorized == expected, "check_permission_authorization outcome differs from expected");
+    }
+}
+
 #if WITH_ONERROR_HANDLER == 1
 // Must match signature of dtrxexec above
 struct dtrxexec_data
@@ -271,6 +520,33 @@ void battlefield::inlinedeep(
     cfaNested.send_context_free();
 }
 
+void battlefield::relay(std::vector<name> route, uint32_t hop, uint32_t hops, string payload, bool write)
+{
+    check(!route.empty(), "relay route must contain at least one account");
+    check(hop < hops, "relay hop must be lower than hops");
+    check(route[hop % route.size()] == _self, "relay hop executing on an account not matching the route");
+
+    if (write)
+    {
+        relays relay_table(_self, _self.value);
+        relay_table.emplace(_self, [&](auto &row) {
+            row.id = relay_table.available_primary_key();
+            row.hop = hop;
+            row.from = hop == 0 ? _self : route[(hop - 1) % route.size()];
+            row.payload = payload;
+            row.created_at = time_point_sec(current_time_point());
+        });
+    }
+
+    if (hop + 1 >= hops)
+    {
+        return;
+    }
+
+    relay_action next(route[(hop + 1) % route.size()], {_self, "active"_n});
+    next.send(route, hop + 1, hops, payload, write);
+}
+
 void battlefield::varianttest(varying_action value)
 {
     std::visit([](auto &&arg) {